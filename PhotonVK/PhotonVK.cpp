@@ -11,9 +11,10 @@ const bool enableValidationLayers = true;
 const int WIDTH = 800;
 const int HEIGHT = 600;
 
-const std::vector<const char*> REQ_VAL_LAYERS = { "VK_LAYER_GOOGLE_threading", "VK_LAYER_LUNARG_parameter_validation", "VK_LAYER_LUNARG_object_tracker", "VK_LAYER_LUNARG_core_validation", "VK_LAYER_LUNARG_monitor", "VK_LAYER_GOOGLE_unique_objects" };
+const std::vector<const char*> REQ_VAL_LAYERS = { "VK_LAYER_KHRONOS_validation" };
 const std::vector<const char*> REQ_INST_EXTENSIONS = { "VK_KHR_surface", "VK_KHR_win32_surface", "VK_EXT_debug_report", "VK_EXT_debug_utils" };
 const std::vector<const char*> REQ_DEV_EXTENSIONS = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+const std::vector<const char*> DYN_RENDERING_DEV_EXTENSIONS = { VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME, VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME, VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME };
 
 const size_t NUM_REQ_QUEUE_FAMILIES = 3;
 enum class QueueFamilyType
@@ -89,6 +90,7 @@ private:
 	vk::RenderPass						vkRenderPass;
 	vk::PipelineLayout				vkPipelineLayout;
 	vk::Pipeline						vkGraphicsPipeline;
+	bool									useDynamicRendering = false;
 	// ------------------------------------------------ //
 	  
 	void createSwapChainImageViews()
@@ -195,6 +197,18 @@ private:
 		{
 			throw std::runtime_error("No suitable physical device found!");
 		}
+
+		// Dynamic rendering is optional, fall back to the render pass path when it is missing
+		useDynamicRendering = checkDynamicRenderingSupport(vkPhysicalDevice);
+		if (useDynamicRendering)
+		{
+			DEBUG_PRINT_VECTOR_DATA("Used Vulkan Device Extensions (dynamic rendering)", DYN_RENDERING_DEV_EXTENSIONS);
+			PRINT_APP_INFO("Dynamic rendering supported, render pass creation is skipped.");
+		}
+		else
+		{
+			PRINT_APP_WARNING("Dynamic rendering not supported, falling back to render pass.");
+		}
 	}
 
 	bool isDeviceSuitable(const vk::PhysicalDevice & device)
@@ -216,10 +230,10 @@ private:
 		return isDiscreteGpu && supportsQueues && supportsReqExt && supportsSwapChain;
 	}
 
-	bool checkDeviceExtensionSupport(const vk::PhysicalDevice& device)
+	bool checkDeviceExtensionSupport(const vk::PhysicalDevice& device, const std::vector<const char*>& reqExtensions = REQ_DEV_EXTENSIONS)
 	{
 		auto extensions = device.enumerateDeviceExtensionProperties(nullptr, vkDispatcher);
-		std::set<std::string> remainingReqExtensions(REQ_DEV_EXTENSIONS.begin(), REQ_DEV_EXTENSIONS.end());
+		std::set<std::string> remainingReqExtensions(reqExtensions.begin(), reqExtensions.end());
 		
 		for (auto ext : extensions) {
 			if (remainingReqExtensions.find(std::string(ext.extensionName)) != remainingReqExtensions.end())
@@ -228,6 +242,19 @@ private:
 		return remainingReqExtensions.empty();
 	}
 
+	bool checkDynamicRenderingSupport(const vk::PhysicalDevice& device)
+	{
+		// getFeatures2 and the multiview/maintenance2 dependencies of the extensions are core 1.1 only
+		if (device.getProperties().apiVersion < VK_API_VERSION_1_1)
+			return false;
+
+		if (checkDeviceExtensionSupport(device, DYN_RENDERING_DEV_EXTENSIONS) == false)
+			return false;
+
+		auto features = device.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceDynamicRenderingFeaturesKHR>(vkDispatcher);
+		return features.get<vk::PhysicalDeviceDynamicRenderingFeaturesKHR>().dynamicRendering == VK_TRUE;
+	}
+
 	vk::SurfaceFormatKHR chooseSwapSurfaceFormat(const std::vector<vk::SurfaceFormatKHR>& availableFormats)
 	{
 		if (availableFormats.size() == 1 && availableFormats[0].format == vk::Format::eUndefined) {
@@ -354,12 +381,19 @@ private:
 		{
 			dqci_arr.push_back(vk::DeviceQueueCreateInfo().setQueueFamilyIndex(queueFamilyIndex).setQueueCount(1).setPQueuePriorities(&prio));
 		}
+		std::vector<const char*> devExtensions(REQ_DEV_EXTENSIONS);
 		vk::PhysicalDeviceFeatures pdf;
 		vk::DeviceCreateInfo dci = vk::DeviceCreateInfo().setQueueCreateInfoCount((uint32_t)dqci_arr.size()).setPQueueCreateInfos(dqci_arr.data()).setPEnabledFeatures(&pdf);
+		vk::PhysicalDeviceDynamicRenderingFeaturesKHR pddrf(true);
+		if (useDynamicRendering)
+		{
+			devExtensions.insert(devExtensions.end(), DYN_RENDERING_DEV_EXTENSIONS.begin(), DYN_RENDERING_DEV_EXTENSIONS.end());
+			dci.pNext = &pddrf;
+		}
 		dci.enabledLayerCount = enableValidationLayers ? static_cast<uint32_t>(REQ_VAL_LAYERS.size()) : 0;
 		dci.ppEnabledLayerNames = enableValidationLayers ? REQ_VAL_LAYERS.data() : nullptr;
-		dci.enabledExtensionCount = (uint32_t)REQ_DEV_EXTENSIONS.size();
-		dci.ppEnabledExtensionNames = REQ_DEV_EXTENSIONS.data();
+		dci.enabledExtensionCount = (uint32_t)devExtensions.size();
+		dci.ppEnabledExtensionNames = devExtensions.data();
 
 		vkDevice = vkPhysicalDevice.createDevice(dci);
 		REGISTER_OBJ_NAME(vkDevice, VkDevice, vk::ObjectType::eDevice);
@@ -401,7 +435,7 @@ private:
 		createLogicalDevice();
 		createSwapChain();
 		createSwapChainImageViews();
-		createRenderPass();
+		if (!useDynamicRendering) createRenderPass();
 		createGraphicsPipeline();
 	}
 
@@ -441,7 +475,18 @@ private:
 		vkPipelineLayout = vkDevice.createPipelineLayout(plci);
 		vk::GraphicsPipelineCreateInfo gpci(vk::PipelineCreateFlags(),2,pssciArr,&vertexInputInfo,&inputAssembly,nullptr, &pvstci, &prsci, &pmsci,nullptr, &colorBlending,nullptr, vkPipelineLayout, vkRenderPass);
 
-		vkGraphicsPipeline = vkDevice.createGraphicsPipeline(vk::PipelineCache(), gpci);
+		// With dynamic rendering the pipeline only needs the attachment formats, not a render pass
+		vk::PipelineRenderingCreateInfoKHR prci(0, 1, &vkSwapChainImageFormat);
+		if (useDynamicRendering)
+		{
+			gpci.renderPass = nullptr;
+			gpci.pNext = &prci;
+		}
+
+		auto pipelineResult = vkDevice.createGraphicsPipeline(vk::PipelineCache(), gpci);
+		if (pipelineResult.result != vk::Result::eSuccess)
+			throw std::runtime_error("Failed to create graphics pipeline!");
+		vkGraphicsPipeline = pipelineResult.value;
 
 		vkDevice.destroy(vkVertShaderModule);
 		vkDevice.destroy(vkFragShaderModule);